@@ -0,0 +1,126 @@
+/*
+ *      Copyright (C) 2025 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "chipdb.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <unistd.h>
+#include <poll.h>
+#include <sys/inotify.h>
+
+namespace K150
+{
+
+CHIPDatabase::~CHIPDatabase()
+{
+  unwatch();
+}
+
+bool CHIPDatabase::load()
+{
+  CHIPInfo parser;
+  parser.setDebug(m_debug);
+  std::shared_ptr<CHIPInfo::INDEX> index = std::make_shared<CHIPInfo::INDEX>();
+  if (!parser.loadindex(m_datfile, *index))
+    return false;
+  std::atomic_store(&m_index, std::shared_ptr<const CHIPInfo::INDEX>(index));
+  return true;
+}
+
+bool CHIPDatabase::watch()
+{
+  if (m_thread.joinable())
+    return true;
+
+  // editors often replace the file, so the directory is watched
+  std::string dir = ".";
+  size_t p = m_datfile.find_last_of('/');
+  if (p != std::string::npos)
+    dir = m_datfile.substr(0, p + 1);
+
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0)
+  {
+    fprintf(stderr, "Watching DAT file '%s' failed.\n", m_datfile.c_str());
+    return false;
+  }
+  if (inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+  {
+    close(fd);
+    fprintf(stderr, "Watching DAT file '%s' failed.\n", m_datfile.c_str());
+    return false;
+  }
+
+  m_stop = false;
+  m_thread = std::thread(&CHIPDatabase::run, this, fd);
+  return true;
+}
+
+void CHIPDatabase::unwatch()
+{
+  if (!m_thread.joinable())
+    return;
+  m_stop = true;
+  m_thread.join();
+}
+
+void CHIPDatabase::run(int fd)
+{
+  std::string name = m_datfile.substr(m_datfile.find_last_of('/') + 1);
+
+  while (!m_stop)
+  {
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    // wake up periodically to check for stop
+    if (poll(&pfd, 1, 500) <= 0)
+      continue;
+
+    bool changed = false;
+    char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    ssize_t len;
+    while ((len = read(fd, buf, sizeof(buf))) > 0)
+    {
+      for (char * ptr = buf; ptr < buf + len; )
+      {
+        const struct inotify_event * event = (const struct inotify_event *) ptr;
+        if (event->len > 0 && name.compare(event->name) == 0)
+          changed = true;
+        ptr += sizeof(struct inotify_event) + event->len;
+      }
+    }
+
+    if (!changed)
+      continue;
+
+    // the current index is kept on failure
+    if (load())
+      fprintf(stderr, "Chip database reloaded (%u chips).\n",
+              (unsigned) index()->size());
+    else
+      fprintf(stderr, "Reloading DAT file '%s' failed.\n", m_datfile.c_str());
+  }
+
+  close(fd);
+}
+
+}
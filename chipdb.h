@@ -0,0 +1,64 @@
+/*
+ *      Copyright (C) 2025 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CHIPDB_H
+#define CHIPDB_H
+
+#include "chipinfo.h"
+
+#include <string>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+namespace K150
+{
+
+// The index of the chip database, reloaded in background when the DAT file
+// changes. A reload builds a new index then swaps it, so any snapshot
+// returned by index() stays unchanged.
+class CHIPDatabase
+{
+public:
+  CHIPDatabase(const std::string& datfile) : m_datfile(datfile) { }
+  ~CHIPDatabase();
+
+  void setDebug(bool debug) { m_debug = debug; }
+
+  bool load();
+  bool watch();
+  void unwatch();
+
+  std::shared_ptr<const CHIPInfo::INDEX> index() const
+  {
+    return std::atomic_load(&m_index);
+  }
+
+private:
+  void run(int fd);
+
+  std::string m_datfile;
+  bool m_debug = false;
+  std::shared_ptr<const CHIPInfo::INDEX> m_index;
+  std::thread m_thread;
+  std::atomic<bool> m_stop { false };
+};
+
+}
+
+#endif /* CHIPDB_H */
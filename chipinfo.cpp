@@ -22,6 +22,35 @@
 namespace K150
 {
 
+bool CHIPInfo::readline(FILE * file, std::string& line)
+{
+  char buf[1024];
+  size_t sz = 0;
+  bool eof = false;
+  bool eol = false;
+  bool blank = true;
+  // read a line
+  do
+  {
+    int c = fgetc(file);
+    if (c < 0)
+      eof = true;
+    else if (c == 0x0a)
+      eol = true;
+    else if (c >= 0x20 && c <= 0x7f)
+    {
+      if (!blank || c != 0x20)
+      {
+        blank = false;
+        buf[sz++] = c;
+      }
+    }
+  } while (!eof && !eol && sz < 1024);
+
+  line.assign(buf, sz);
+  return !eof;
+}
+
 void CHIPInfo::dumplist(const std::string& datfile, const std::string& filter)
 {
   FILE * file = fopen(datfile.c_str(), "r");
@@ -31,32 +60,13 @@ void CHIPInfo::dumplist(const std::string& datfile, const std::string& filter)
     return;
   }
   std::string _filter = upperStr(filter);
-  for (;;)
+  std::string line;
+  bool more;
+  do
   {
-    char buf[1024];
-    size_t sz = 0;
-    bool eof = false;
-    bool eol = false;
-    bool blank = true;
-    // read a line
-    do
-    {
-      int c = fgetc(file);
-      if (c < 0)
-        eof = true;
-      else if (c == 0x0a)
-        eol = true;
-      else if (c >= 0x20 && c <= 0x7f)
-      {
-        if (!blank || c != 0x20)
-        {
-          blank = false;
-          buf[sz++] = c;
-        }
-      }
-    } while (!eof && !eol && sz < 1024);
+    more = readline(file, line);
 
-    std::vector<std::string> var = tokenize(std::string(buf, sz), '=', '"', false);
+    std::vector<std::string> var = tokenize(line, '=', '"', false);
     if (var.size() > 1)
     {
       std::string vn = upperStr(var[0]);
@@ -68,15 +78,58 @@ void CHIPInfo::dumplist(const std::string& datfile, const std::string& filter)
           fprintf(stdout, "%s\n", chipname.c_str());
       }
     }
-
-    if (eof)
-      break;
-  }
+  } while (more);
 
   fclose(file);
 }
 
-bool CHIPInfo::loaddata(const std::string& datfile, const std::string& chipname)
+bool CHIPInfo::setvar(CHIP& chip, const std::string& vn, const std::string& value)
+{
+  if (vn == "CHIPID")
+    chip.chip_id = unwrap(value);
+  else if (vn == "SOCKETIMAGE")
+    chip.socket_image = upperStr(unwrap(value));
+  else if (vn == "ERASEMODE")
+    chip.erase_mode = atoi(unwrap(value).c_str());
+  else if (vn == "POWERSEQUENCE")
+    chip.power_sequence = upperStr(unwrap(value));
+  else if (vn == "PROGRAMDELAY")
+    chip.program_delay = atoi(unwrap(value).c_str());
+  else if (vn == "PROGRAMTRIES")
+    chip.program_tries = atoi(unwrap(value).c_str());
+  else if (vn == "PANELSIZING")
+    chip.panel_sizing = atoi(unwrap(value).c_str());
+  else if (vn == "CORETYPE")
+    chip.core_type = upperStr(unwrap(value));
+  else if (vn == "ROMSIZE")
+    chip.rom_size = (int) ::strtoul(unwrap(value).c_str(), nullptr, 16);
+  else if (vn == "EEPROMSIZE")
+    chip.eeprom_size = (int) ::strtoul(unwrap(value).c_str(), nullptr, 16);
+  else if (vn == "FUSEBLANK")
+  {
+    chip.fuse_blank.clear();
+    for (std::string& m : tokenize(unwrap(value), ' ', '\0', true))
+      chip.fuse_blank.push_back((int) ::strtoul(m.c_str(), nullptr, 16));
+  }
+  else if (vn == "INCLUDE")
+    chip.include = (upperStr(unwrap(value)) == "Y");
+  else if (vn == "FLASHCHIP")
+    chip.flash_chip = (upperStr(unwrap(value)) == "Y");
+  else if (vn == "CPWARN")
+    chip.cp_warn = (upperStr(unwrap(value)) == "Y");
+  else if (vn == "CALWORD")
+    chip.cal_word = (upperStr(unwrap(value)) == "Y");
+  else if (vn == "BANDGAP")
+    chip.band_gap = (upperStr(unwrap(value)) == "Y");
+  else if (vn == "ICSPONLY")
+    chip.icsp_only = (upperStr(unwrap(value)) == "Y");
+  else
+    return false;
+  return true;
+}
+
+bool CHIPInfo::parse(const std::string& datfile, const std::string& chipname,
+        INDEX& index, int& errors)
 {
   FILE * file = fopen(datfile.c_str(), "r");
   if (file == nullptr)
@@ -84,42 +137,29 @@ bool CHIPInfo::loaddata(const std::string& datfile, const std::string& chipname)
     fprintf(stderr, "Opening DAT file '%s' failed.\n", datfile.c_str());
     return false;
   }
+  std::string filter = upperStr(chipname);
   bool chipfound = false;
-  m_info = CHIP();
-  m_info.valid = false;
-  m_info.chip_name = upperStr(chipname);
-  for (;;)
+  CHIP chip;
+  errors = 0;
+  std::string line;
+  bool more;
+  do
   {
-    char buf[1024];
-    size_t sz = 0;
-    bool eof = false;
-    bool eol = false;
-    bool blank = true;
-    // read a line
-    do
-    {
-      int c = fgetc(file);
-      if (c < 0)
-        eof = true;
-      else if (c == 0x0a)
-        eol = true;
-      else if (c >= 0x20 && c <= 0x7f)
-      {
-        if (!blank || c != 0x20)
-        {
-          blank = false;
-          buf[sz++] = c;
-        }
-      }
-    } while (!eof && !eol && sz < 1024);
+    more = readline(file, line);
 
-    std::vector<std::string> tokens = tokenize(std::string(buf, sz), ' ', '"', true);
+    std::vector<std::string> tokens = tokenize(line, ' ', '"', true);
 
     if (tokens.size() == 0)
     {
-      // blank line
+      // blank line ends the chip, the first one of a name is kept
       if (chipfound)
-        break;
+      {
+        chip.valid = true;
+        index.insert(std::make_pair(chip.chip_name, chip));
+        if (!filter.empty())
+          break;
+      }
+      chipfound = false;
     }
     else if (tokens[0].compare(0, 1, "#") == 0)
     {
@@ -131,63 +171,33 @@ bool CHIPInfo::loaddata(const std::string& datfile, const std::string& chipname)
     }
     else
     {
-      std::vector<std::string> var = tokenize(std::string(buf, sz), '=', '"', false);
+      std::vector<std::string> var = tokenize(line, '=', '"', false);
       if (var.size() > 1)
       {
         std::string vn = upperStr(var[0]);
-        if (!chipfound)
+        if (vn == "CHIPNAME")
         {
-          // looking for var CHIPNAME
-          if (vn == "CHIPNAME" && upperStr(unwrap(var[1])) == m_info.chip_name)
-            chipfound = true;
+          if (chipfound)
+          {
+            chip.valid = true;
+            index.insert(std::make_pair(chip.chip_name, chip));
+            if (!filter.empty())
+              break;
+          }
+          chip = CHIP();
+          chip.chip_name = upperStr(unwrap(var[1]));
+          // looking for the given chip only
+          chipfound = (filter.empty() || chip.chip_name == filter);
         }
-        else
+        else if (chipfound)
         {
-          if (m_debug)
+          if (m_debug && !filter.empty())
             fprintf(stderr, ">>> CHIPINFO::%s=%s\n", vn.c_str(), var[1].c_str());
-          // set infos
-          if (vn == "CHIPID")
-            m_info.chip_id = unwrap(var[1]);
-          else if (vn == "SOCKETIMAGE")
-            m_info.socket_image = upperStr(unwrap(var[1]));
-          else if (vn == "ERASEMODE")
-            m_info.erase_mode = atoi(unwrap(var[1]).c_str());
-          else if (vn == "POWERSEQUENCE")
-            m_info.power_sequence = upperStr(unwrap(var[1]));
-          else if (vn == "PROGRAMDELAY")
-            m_info.program_delay = atoi(unwrap(var[1]).c_str());
-          else if (vn == "PROGRAMTRIES")
-            m_info.program_tries = atoi(unwrap(var[1]).c_str());
-          else if (vn == "PANELSIZING")
-            m_info.panel_sizing = atoi(unwrap(var[1]).c_str());
-          else if (vn == "CORETYPE")
-            m_info.core_type = upperStr(unwrap(var[1]));
-          else if (vn == "ROMSIZE")
-            m_info.rom_size = (int) ::strtoul(unwrap(var[1]).c_str(), nullptr, 16);
-          else if (vn == "EEPROMSIZE")
-            m_info.eeprom_size = (int) ::strtoul(unwrap(var[1]).c_str(), nullptr, 16);
-          else if (vn == "FUSEBLANK")
-          {
-            m_info.fuse_blank.clear();
-            for (std::string& m : tokenize(unwrap(var[1]), ' ', '\0', true))
-              m_info.fuse_blank.push_back((int) ::strtoul(m.c_str(), nullptr, 16));
-          }
-          else if (vn == "INCLUDE")
-            m_info.include = (upperStr(unwrap(var[1])) == "Y");
-          else if (vn == "FLASHCHIP")
-            m_info.flash_chip = (upperStr(unwrap(var[1])) == "Y");
-          else if (vn == "CPWARN")
-            m_info.cp_warn = (upperStr(unwrap(var[1])) == "Y");
-          else if (vn == "CALWORD")
-            m_info.cal_word = (upperStr(unwrap(var[1])) == "Y");
-          else if (vn == "BANDGAP")
-            m_info.band_gap = (upperStr(unwrap(var[1])) == "Y");
-          else if (vn == "ICSPONLY")
-            m_info.icsp_only = (upperStr(unwrap(var[1])) == "Y");
-          else
+          if (!setvar(chip, vn, var[1]))
           {
-            fprintf(stderr, ">>> INVALID CHIP INFO: %s\n", std::string(buf, sz).c_str());
+            fprintf(stderr, ">>> INVALID CHIP INFO: %s\n", line.c_str());
             chipfound = false;
+            errors += 1;
           }
         }
       }
@@ -195,16 +205,52 @@ bool CHIPInfo::loaddata(const std::string& datfile, const std::string& chipname)
       {
         fprintf(stderr, ">>> PARSE ERROR: %s\n", var[0].c_str());
         chipfound = false;
+        errors += 1;
       }
     }
+  } while (more);
 
-    if (eof)
-      break;
+  if (chipfound)
+  {
+    chip.valid = true;
+    index.insert(std::make_pair(chip.chip_name, chip));
   }
 
   fclose(file);
-  m_info.valid = chipfound;
-  return chipfound;
+  return true;
+}
+
+bool CHIPInfo::loaddata(const std::string& datfile, const std::string& chipname)
+{
+  INDEX index;
+  int errors;
+  parse(datfile, chipname, index, errors);
+  return loaddata(index, chipname);
+}
+
+bool CHIPInfo::loaddata(const INDEX& index, const std::string& chipname)
+{
+  INDEX::const_iterator it = index.find(upperStr(chipname));
+  if (it == index.end())
+  {
+    m_info = CHIP();
+    m_info.chip_name = upperStr(chipname);
+    return false;
+  }
+  m_info = it->second;
+  return true;
+}
+
+bool CHIPInfo::loadindex(const std::string& datfile, INDEX& index)
+{
+  index.clear();
+  int errors;
+  if (!parse(datfile, std::string(), index, errors))
+    return false;
+  if (m_debug)
+    fprintf(stderr, ">>> CHIPINFO %u chips indexed, %d errors\n", (unsigned) index.size(), errors);
+  // a partial index is rejected, as the file could be saved while editing
+  return (errors == 0 && !index.empty());
 }
 
 }
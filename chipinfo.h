@@ -21,6 +21,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <cstdio>
 
 namespace K150
 {
@@ -66,13 +68,21 @@ public:
     std::vector<FUSE> fuses;
   };
 
+  typedef std::map<std::string, CHIP> INDEX;
+
   bool loaddata(const std::string& datfile, const std::string& chipname);
+  bool loaddata(const INDEX& index, const std::string& chipname);
+  bool loadindex(const std::string& datfile, INDEX& index);
 
   const CHIP& data() const { return m_info; }
 
 private:
   bool m_debug;
   CHIP m_info;
+
+  static bool readline(FILE * file, std::string& line);
+  bool setvar(CHIP& chip, const std::string& vn, const std::string& value);
+  bool parse(const std::string& datfile, const std::string& chipname, INDEX& index, int& errors);
   
   std::string upperStr(const std::string& buf)
   {
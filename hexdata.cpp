@@ -19,6 +19,11 @@
 #include "hexdata.h"
 
 #include <cassert>
+#include <cstring>
+#include <thread>
+#include <functional>
+
+#define HEX_LINES_PER_THREAD  4096
 
 namespace K150
 {
@@ -73,57 +78,58 @@ void HexData::logdata(FILE * out, const std::vector<uint8_t>& data)
   }
 }
 
-std::vector<uint8_t> HexData::readline(FILE * file)
+std::vector<uint8_t> HexData::readline(const char * buf, const char * end)
 {
-  std::vector<uint8_t> buf;
-  bool eof = false;
-  bool eol = false;
+  std::vector<uint8_t> line;
   bool blank = true;
-  // read a line
-  do
+  while (buf < end)
   {
-    int c = fgetc(file);
-    if (c < 0)
-      eof = true;
-    else if (c == 0x0a)
-      eol = true;
-    else if (c >= 0x20 && c <= 0x7f)
+    unsigned char c = *buf++;
+    if (c >= 0x20 && c <= 0x7f)
     {
       if (!blank || c != 0x20)
       {
         blank = false;
-        buf.push_back(c);
+        line.push_back(c);
       }
     }
-  } while (!eof && !eol);
-
-  return buf;
+  }
+  return line;
 }
 
-bool HexData::loadHEX(const std::string& path)
+struct HexData::Chunk
 {
-  FILE * file = fopen(path.c_str(), "r");
-  if (file == nullptr)
-    return false;
-
-  int lno = 0;
-  bool eof = false;
-
-  m_segments.clear();
-  int ext_address = 0;
+  size_t first_line         = 0;  // index of the first line
+  size_t last_line          = 0;  // index past the last line
+  int ext_address           = 0;  // extended address at the first line
+  std::map<int, std::vector<uint8_t> > segments;
+  bool stop                 = false;  // decoding stopped before last line
+  bool eof                  = false;  // stopped on the EOF record
+  int lno                   = 0;  // line number of the failed record
+  std::string error;               // message for the failed record
+  std::vector<uint8_t> line;      // the failed record
+};
+
+void HexData::decodeChunk(const char * buf, const std::vector<size_t>& lines, Chunk& chunk)
+{
+  int ext_address = chunk.ext_address;
 
-  for (;;)
+  for (size_t n = chunk.first_line; n < chunk.last_line; ++n)
   {
     char hex[4];
-    std::vector<uint8_t> line = readline(file);
+    char msg[64];
+    // the line ends before the next line feed
+    std::vector<uint8_t> line = readline(buf + lines[n], buf + lines[n + 1] - 1);
     int sum = 0;
-    lno += 1;
+    chunk.lno = n + 1;
 
     if (line.size() < 3 || line[0] != ':')
     {
-      logdata(stderr, line);
-      fprintf(stderr, "Invalid format at line %d.\n", lno);
-      break;
+      snprintf(msg, sizeof(msg), "Invalid format at line %d.\n", chunk.lno);
+      chunk.error.assign(msg);
+      chunk.line.swap(line);
+      chunk.stop = true;
+      return;
     }
 
     hex[0] = line[1];
@@ -133,9 +139,11 @@ bool HexData::loadHEX(const std::string& path)
 
     if (line.size() != (2 * (reclen + 5) + 1))
     {
-      logdata(stderr, line);
-      fprintf(stderr, "Record size is invalid at line %d.\n", lno);
-      break;
+      snprintf(msg, sizeof(msg), "Record size is invalid at line %d.\n", chunk.lno);
+      chunk.error.assign(msg);
+      chunk.line.swap(line);
+      chunk.stop = true;
+      return;
     }
 
     hex[0] = line[3];
@@ -169,13 +177,13 @@ bool HexData::loadHEX(const std::string& path)
         data.push_back(b1);
         data.push_back(b2);
       }
-      m_segments.insert(std::pair<int, std::vector<uint8_t> >(recaddr, data));
+      chunk.segments.insert(std::pair<int, std::vector<uint8_t> >(recaddr, data));
     }
     else if (rectype == 1)
     {
-      if (reclen == 0)
-        eof = true;
-      break;
+      chunk.eof = (reclen == 0);
+      chunk.stop = true;
+      return;
     }
     else if (rectype == 2)
     {
@@ -204,9 +212,11 @@ bool HexData::loadHEX(const std::string& path)
     else
     {
       // not implemented
-      logdata(stderr, line);
-      fprintf(stderr, "Record type %d is not supported.\n", rectype);
-      break;
+      snprintf(msg, sizeof(msg), "Record type %d is not supported.\n", rectype);
+      chunk.error.assign(msg);
+      chunk.line.swap(line);
+      chunk.stop = true;
+      return;
     }
 
     hex[0] = line[line.size()-2];
@@ -214,14 +224,149 @@ bool HexData::loadHEX(const std::string& path)
     int crc = hex_to_num(hex, 2);
     if (crc != ((~sum + 1) &0xff))
     {
-      logdata(stderr, line);
-      fprintf(stderr, "Bad CRC for record at line %d\n", lno);
-      break;
+      snprintf(msg, sizeof(msg), "Bad CRC for record at line %d\n", chunk.lno);
+      chunk.error.assign(msg);
+      chunk.line.swap(line);
+      chunk.stop = true;
+      return;
     }
   }
+}
 
+bool HexData::loadHEX(const std::string& path)
+{
+  FILE * file = fopen(path.c_str(), "r");
+  if (file == nullptr)
+    return false;
+
+  std::vector<char> buf;
+  for (;;)
+  {
+    char tmp[65536];
+    size_t rc = fread(tmp, 1, sizeof(tmp), file);
+    buf.insert(buf.end(), tmp, tmp + rc);
+    if (rc == 0)
+      break;
+  }
   fclose(file);
 
+  m_segments.clear();
+
+  // pre-scan: locate the line boundaries and the extended address records.
+  // The offsets are terminated by a sentinel past the end of buffer, so
+  // the line n spans [lines[n], lines[n+1] - 1).
+  std::vector<size_t> lines;
+  std::vector<std::pair<size_t, int> > ext_records;
+  {
+    const char * beg = buf.data();
+    const char * end = beg + buf.size();
+    int ext_address = 0;
+    size_t pos = 0;
+    for (;;)
+    {
+      lines.push_back(pos);
+      const char * eol = static_cast<const char*>(memchr(beg + pos, 0x0a, buf.size() - pos));
+      if (eol == nullptr)
+        eol = end;
+
+      // peek the record type and the extended address
+      char head[13];
+      int hsz = 0;
+      bool blank = true;
+      for (const char * p = beg + pos; p < eol && hsz < 13; ++p)
+      {
+        unsigned char c = *p;
+        if (c >= 0x20 && c <= 0x7f && (!blank || c != 0x20))
+        {
+          blank = false;
+          head[hsz++] = c;
+        }
+      }
+      if (hsz >= 9 && head[0] == ':')
+      {
+        int rectype = hex_to_num(head + 7, 2);
+        if (rectype == 1)
+        {
+          // no need to decode anything past the EOF record
+          pos = (eol == end ? buf.size() + 1 : eol - beg + 1);
+          break;
+        }
+        if (hsz == 13 && (rectype == 2 || rectype == 4))
+        {
+          int shift = hex_to_num(head + 9, 4);
+          ext_address = (rectype == 2 ? shift << 4 : shift << 16);
+          ext_records.push_back(std::make_pair(lines.size(), ext_address));
+        }
+      }
+
+      if (eol == end)
+      {
+        pos = buf.size() + 1;
+        break;
+      }
+      pos = eol - beg + 1;
+    }
+    lines.push_back(pos);
+  }
+
+  size_t line_count = lines.size() - 1;
+
+  // split lines into chunks, knowing the extended address at their start
+  unsigned nthreads = std::thread::hardware_concurrency();
+  if (nthreads == 0)
+    nthreads = 1;
+  if (nthreads > line_count / HEX_LINES_PER_THREAD)
+    nthreads = (line_count / HEX_LINES_PER_THREAD > 0 ? line_count / HEX_LINES_PER_THREAD : 1);
+
+  std::vector<Chunk> chunks(nthreads);
+  {
+    size_t e = 0;
+    int ext_address = 0;
+    for (unsigned i = 0; i < nthreads; ++i)
+    {
+      chunks[i].first_line = i * line_count / nthreads;
+      chunks[i].last_line = (i + 1) * line_count / nthreads;
+      while (e < ext_records.size() && ext_records[e].first <= chunks[i].first_line)
+        ext_address = ext_records[e++].second;
+      chunks[i].ext_address = ext_address;
+    }
+  }
+
+  if (m_debug)
+    fprintf(stderr, ">>> HEX %u lines, %u chunks\n", (unsigned) line_count, nthreads);
+
+  // decode the chunks, the first one on the calling thread
+  std::vector<std::thread> workers;
+  for (unsigned i = 1; i < nthreads; ++i)
+    workers.push_back(std::thread(&HexData::decodeChunk, buf.data(), std::cref(lines), std::ref(chunks[i])));
+  decodeChunk(buf.data(), lines, chunks[0]);
+  for (std::thread& t : workers)
+    t.join();
+
+  // merge the segments until the first stop
+  bool eof = false;
+  bool stop = false;
+  for (Chunk& chunk : chunks)
+  {
+    for (auto& e : chunk.segments)
+      m_segments.insert(std::pair<int, std::vector<uint8_t> >(e.first, std::move(e.second)));
+    if (chunk.stop)
+    {
+      stop = true;
+      eof = chunk.eof;
+      if (!chunk.error.empty())
+      {
+        logdata(stderr, chunk.line);
+        fputs(chunk.error.c_str(), stderr);
+      }
+      break;
+    }
+  }
+
+  // no EOF record: the line past the end is empty, so it is invalid
+  if (!stop)
+    fprintf(stderr, "Invalid format at line %d.\n", (int) line_count + 1);
+
   if (!eof)
     return false;
 
@@ -34,7 +34,9 @@ private:
   static int hex_to_num(const char * str, int sz);
   static void u8_to_hex(std::string& str, uint8_t u);
   static void logdata(FILE * out, const std::vector<uint8_t>& data);
-  static std::vector<uint8_t> readline(FILE * file);
+  static std::vector<uint8_t> readline(const char * buf, const char * end);
+  struct Chunk;
+  static void decodeChunk(const char * buf, const std::vector<size_t>& lines, Chunk& chunk);
   std::string hexrecord(int& ext_addr, int addr, const std::vector<uint8_t>& data);
 
 public:
@@ -29,6 +29,10 @@
 #include <stdlib.h>
 #include <fcntl.h>
 
+// bytes sent by the firmware while the stop byte is on the way, given the
+// latency of USB adapters at 19200 bauds
+#define READ_STOP_MARGIN  256
+
 namespace K150
 {
 
@@ -144,11 +148,62 @@ bool Programmer::connect(COMPort * port)
   if (!m_port->isopen())
     return false;
 
-  m_port->reset();
+  // the firmware could be already idle from a previous session, so try to
+  // attach it before going through the reset and the boot delay
+  if (!attach())
+  {
+    if (m_debug)
+      fprintf(stderr, ">>> Fast attach failed, resetting the device\n");
+
+    m_port->reset();
+    try
+    {
+      m_buffer.clear();
+      while (m_buffer.size() < 2)
+        m_port->readData(m_buffer);
+    }
+    catch (...)
+    {
+      return false;
+    }
+
+    if (m_debug)
+      logbuffer(stderr);
+
+    if (m_buffer[0] != 'B')
+      return false;
+    m_version = m_buffer[1];
+
+    if (!commandStart())
+      return false;
+
+    queryProtocol();
+    commandEnd();
+  }
+
+  if (m_protocol != "P18A")
+  {
+    fprintf(stderr, "Unsupported protocol (%s).\n", m_protocol.c_str());
+    return false;
+  }
+
+  fprintf(stderr, "Programmer %s speaks protocol %s.\n",
+          getVersionName().c_str(), getProtocol().c_str());
+  return true;
+}
+
+bool Programmer::attach()
+{
+  // command 1 returns 'Q' either the firmware waits for command start or
+  // it monitors the jump table. The deadline is short as a silent board
+  // will be reset anyway.
+  std::vector<uint8_t> msg = { 1 };
+  m_port->writeData(msg);
   try
   {
     m_buffer.clear();
-    while (m_buffer.size() < 2)
+    int attempt = 0;
+    while ((m_buffer.empty() || m_buffer.back() != 'Q') && attempt++ < 3)
       m_port->readData(m_buffer);
   }
   catch (...)
@@ -159,20 +214,37 @@ bool Programmer::connect(COMPort * port)
   if (m_debug)
     logbuffer(stderr);
 
-  if (m_buffer[0] != 'B')
+  if (m_buffer.empty() || m_buffer.back() != 'Q')
     return false;
-  m_version = m_buffer[1];
 
-  if (!commandStart())
+  // go to jump table
+  msg = { 'P' };
+  m_port->writeData(msg);
+  try
+  {
+    m_buffer.clear();
+    int attempt = 0;
+    while (m_buffer.size() < 1 && attempt++ < 3)
+      m_port->readData(m_buffer);
+  }
+  catch (...)
+  {
     return false;
+  }
 
-  std::vector<uint8_t> cmd = { 21 };
-  m_port->writeData(cmd);
+  if (m_debug)
+    logbuffer(stderr);
+
+  if (m_buffer.size() != 1 || m_buffer[0] != 'P')
+    return false;
+
+  msg = { 20 }; // GET VERSION
+  m_port->writeData(msg);
   try
   {
     m_buffer.clear();
     int attempt = 0;
-    while (m_buffer.size() < 4 && attempt++ < 10)
+    while (m_buffer.size() < 1 && attempt++ < 3)
       m_port->readData(m_buffer);
   }
   catch (...)
@@ -183,20 +255,62 @@ bool Programmer::connect(COMPort * port)
   if (m_debug)
     logbuffer(stderr);
 
-  m_protocol.clear();
-  for (unsigned char c : m_buffer)
-    m_protocol.push_back(static_cast<char>(c));
-  if (m_protocol != "P18A")
+  if (m_buffer.size() != 1 || m_buffer[0] > 3)
+    return false;
+  m_version = m_buffer[0];
+
+  if (!queryProtocol())
+    return false;
+
+  // a former session could have been killed with voltages on, so turn them
+  // off as the reset would do
+  msg = { 5 };
+  m_port->writeData(msg);
+  try
+  {
+    m_buffer.clear();
+    int attempt = 0;
+    while (m_buffer.size() < 1 && attempt++ < 3)
+      m_port->readData(m_buffer);
+  }
+  catch (...)
   {
-    fprintf(stderr, "Unsupported protocol (%s).\n", m_protocol.c_str());
     return false;
   }
 
-  commandEnd();
+  if (m_debug)
+    logbuffer(stderr);
 
-  fprintf(stderr, "Programmer %s speaks protocol %s.\n",
-          getVersionName().c_str(), getProtocol().c_str());
-  return true;
+  if (m_buffer.size() != 1 || m_buffer[0] != 'v')
+    return false;
+  m_VPPEnabled = false;
+
+  return commandEnd();
+}
+
+bool Programmer::queryProtocol()
+{
+  std::vector<uint8_t> msg = { 21 }; // GET PROTOCOL
+  m_port->writeData(msg);
+  try
+  {
+    m_buffer.clear();
+    int attempt = 0;
+    while (m_buffer.size() < 4 && attempt++ < 10)
+      m_port->readData(m_buffer);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  if (m_debug)
+    logbuffer(stderr);
+
+  m_protocol.clear();
+  for (unsigned char c : m_buffer)
+    m_protocol.push_back(static_cast<char>(c));
+  return (m_buffer.size() == 4);
 }
 
 void Programmer::disconnect()
@@ -290,6 +404,8 @@ bool Programmer::configure(const CHIPInfo& info)
   m_props.erase_mode = info.data().erase_mode;
   m_props.panel_sizing = info.data().panel_sizing;
   m_props.fuse_blank = info.data().fuse_blank;
+  if (!info.data().chip_id.empty())
+    m_props.chip_id = (int) ::strtoul(info.data().chip_id.c_str(), nullptr, 16) & 0xffff;
   m_props.flag_flash_chip = info.data().flash_chip;
   m_props.flag_calibration_value_in_rom = info.data().cal_word;
   m_props.flag_band_gap_fuse = info.data().band_gap;
@@ -1025,6 +1141,49 @@ bool Programmer::isBlankEEPROM()
   return false;
 }
 
+bool Programmer::checkChipID()
+{
+  assert(m_VPPEnabled == true);
+
+  // FFFF stands for chip without device ID, as 12 bits cores
+  if (m_props.chip_id == 0xffff || m_props.core_bits == 12)
+    return true;
+
+  std::vector<uint8_t> msg = { 13 };
+  m_port->writeData(msg);
+  try
+  {
+    m_buffer.clear();
+    while (m_buffer.size() < 27)
+      m_port->readData(m_buffer);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  if (m_debug)
+    logbuffer(stderr);
+
+  if (m_buffer[0] != 'C')
+  {
+    fprintf(stderr, "Command failed.\n");
+    return false;
+  }
+
+  // the 5 lower bits hold the silicon revision
+  int mask = (m_props.core_bits == 16 ? 0xffe0 : 0x3fe0);
+  int chip_id = m_buffer[1] | (m_buffer[2] << 8);
+  if ((chip_id & mask) != (m_props.chip_id & mask))
+  {
+    fprintf(stderr, "Chip ID %04X does not match the expected ID %04X.\n",
+            chip_id, m_props.chip_id);
+    return false;
+  }
+
+  return true;
+}
+
 bool Programmer::readCONFIG(std::vector<int>& fuses)
 {
   assert(m_VPPEnabled == true);
@@ -1083,11 +1242,12 @@ bool Programmer::readCONFIG(std::vector<int>& fuses)
   return true;
 }
 
-bool Programmer::readROM(std::vector<uint8_t>& data)
+bool Programmer::readROM(std::vector<uint8_t>& data, ReadHandler * handler /*= nullptr*/)
 {
   assert(m_VPPEnabled == true);
 
   int ds = m_props.rom_size * 2; // words to bytes
+  bool stopped = false;
 
   std::vector<uint8_t> msg = { 11 };
   m_port->writeData(msg);
@@ -1098,6 +1258,31 @@ bool Programmer::readROM(std::vector<uint8_t>& data)
     {
       m_port->readData(m_buffer);
       show_progress(stderr, m_buffer.size(), ds);
+      if (handler != nullptr && !handler->received(m_buffer))
+      {
+        // close to the end, the transfer could be over before the stop
+        // byte is received, then it would be taken as a command
+        if (ds - m_buffer.size() > READ_STOP_MARGIN)
+        {
+          stopped = true;
+          break;
+        }
+        handler = nullptr;
+      }
+    }
+
+    if (stopped)
+    {
+      // a byte received during transfer stops it, then drain the data
+      // already sent
+      msg = { 0 };
+      m_port->writeData(msg);
+      size_t sz;
+      do
+      {
+        sz = m_buffer.size();
+        m_port->readData(m_buffer);
+      } while (m_buffer.size() != sz);
     }
   }
   catch (...)
@@ -1110,7 +1295,7 @@ bool Programmer::readROM(std::vector<uint8_t>& data)
   if (m_debug)
     logbuffer(stderr);
 
-  if (m_buffer.size() != ds)
+  if (!stopped && m_buffer.size() != ds)
   {
     fprintf(stderr, "Command failed.\n");
     return false;
@@ -1118,6 +1303,11 @@ bool Programmer::readROM(std::vector<uint8_t>& data)
 
   data = m_buffer;
 
+  // the transfer ended before the stop byte, which has been taken as the
+  // command 0 (wait for command start), so go back to the jump table
+  if (stopped && data.size() == ds && !commandStart())
+    return false;
+
   return true;
 }
 
@@ -47,10 +47,19 @@ public:
   virtual void status(bool connected) = 0;
 };
 
+class ReadHandler
+{
+public:
+  // return false to stop the transfer
+  virtual bool received(const std::vector<uint8_t>& data) = 0;
+};
+
 class Programmer
 {
 private:
   void logbuffer(FILE * out);
+  bool attach();
+  bool queryProtocol();
 
 public:
   Programmer() { }
@@ -73,6 +82,7 @@ public:
     int program_tries                       = 0;
     int panel_sizing                        = 0;
     int config_base                         = 0;
+    int chip_id                             = 0xffff;
     std::vector<int> fuse_blank;
     bool flag_calibration_value_in_rom      = false;
     bool flag_band_gap_fuse                 = false;
@@ -114,8 +124,9 @@ public:
   bool isBlankROM();
   bool isBlankEEPROM();
 
+  bool checkChipID();
   bool readCONFIG(std::vector<int>& fuses);
-  bool readROM(std::vector<uint8_t>& data);
+  bool readROM(std::vector<uint8_t>& data, ReadHandler * handler = nullptr);
   bool readEEPROM(std::vector<uint8_t>& data);
 
 private:
@@ -17,12 +17,19 @@
  */
 
 #include <cstdlib>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdexcept>
 #include <unistd.h>
 
 #include "serialport/serialport.h"
 #include "k150.h"
 #include "chipinfo.h"
+#include "chipdb.h"
 #include "hexdata.h"
+#include "usbmonitor.h"
 #include "usage.h"
 
 #ifdef VERSION_STRING
@@ -58,6 +65,12 @@ bool load_chip_info(
         const std::string& chipname
 );
 
+bool load_chip_info(
+        K150::CHIPInfo& info,
+        const K150::CHIPInfo::INDEX& index,
+        const std::string& chipname
+);
+
 bool read_pic(
         K150::Programmer& programmer,
         bool icsp_mode,
@@ -98,30 +111,72 @@ bool isblank_pic(
         bool program_eeprom
 );
 
+bool whichfw_pic(
+        K150::Programmer& programmer,
+        const std::vector<std::string>& images,
+        bool icsp_mode
+);
+
 //
 // implement COMPort
 //
 class SerialPort : public K150::COMPort
 {
   Serial::SerialPort& m_port;
+  std::atomic<bool> m_lost { false };
 public:
   SerialPort(Serial::SerialPort& port) : m_port(port) { }
 
   void writeData(const std::vector<uint8_t>& data) override
   {
-    m_port.WriteBinary(data);
+    // writes are outside the error handling of the programmer, so a
+    // failure marks the port as lost, then the next read will fail
+    if (m_lost)
+      return;
+    try
+    {
+      m_port.WriteBinary(data);
+    }
+    catch (...)
+    {
+      m_lost = true;
+    }
   }
   void readData(std::vector<uint8_t>& data) override
   {
+    if (m_lost)
+      throw std::runtime_error("device lost");
+    try
+    {
       m_port.ReadBinary(data);
+    }
+    catch (...)
+    {
+      m_lost = true;
+      throw;
+    }
   }
   void open() override
   {
-    m_port.Open();
+    try
+    {
+      m_port.Open();
+    }
+    catch (std::exception& e)
+    {
+      fprintf(stderr, "%s\n", e.what());
+    }
   }
   void close() override
   {
-    m_port.Close();
+    try
+    {
+      m_port.Close();
+    }
+    catch (...)
+    {
+      // the device could be gone
+    }
   }
   bool isopen() override
   {
@@ -131,6 +186,65 @@ public:
   {
     m_port.ResetDevice();
   }
+  void setDevice(const std::string& device)
+  {
+    m_port.SetDevice(device);
+  }
+  void setLost(bool lost)
+  {
+    m_lost = lost;
+  }
+  bool lost()
+  {
+    return m_lost;
+  }
+};
+
+//
+// implement Callback
+//
+class Session : public K150::Callback
+{
+  SerialPort& m_port;
+  std::mutex m_lock;
+  std::condition_variable m_cond;
+  bool m_connected = true;
+public:
+  Session(SerialPort& port) : m_port(port) { }
+
+  void status(bool connected) override
+  {
+    {
+      std::lock_guard<std::mutex> g(m_lock);
+      m_connected = connected;
+    }
+    // abort pending I/O at once
+    m_port.setLost(!connected);
+    if (connected)
+      fprintf(stderr, "Programmer plugged in.\n");
+    else
+      fprintf(stderr, "Programmer unplugged.\n");
+    m_cond.notify_all();
+  }
+  void reset()
+  {
+    {
+      std::lock_guard<std::mutex> g(m_lock);
+      m_connected = false;
+    }
+    m_port.setLost(true);
+  }
+  bool connected()
+  {
+    // the port fails before the monitor tells the unplug
+    std::lock_guard<std::mutex> g(m_lock);
+    return m_connected && !m_port.lost();
+  }
+  void waitConnected()
+  {
+    std::unique_lock<std::mutex> g(m_lock);
+    m_cond.wait(g, [this]{ return m_connected; });
+  }
 };
 
 //
@@ -147,6 +261,8 @@ enum Operation {
   VERIFY    = 7,
   ISBLANK   = 8,
   PING      = 9,
+  STATION   = 10,
+  WHICHFW   = 11,
 };
 
 int main(int argc, char** argv)
@@ -158,6 +274,7 @@ int main(int argc, char** argv)
   std::string newhex;
   std::string outhex;
   std::string list_filter;
+  std::vector<std::string> images;
   std::vector<uint8_t> ID;
   Operation op = NONE;
   bool debug = false;
@@ -300,6 +417,24 @@ int main(int argc, char** argv)
       }
       op = PROGRAM;
     }
+    else if (op == NONE && ::strcmp(argv[n], "station") == 0 && n < argc-1)
+    {
+      n += 1;
+      if (::strcmp(argv[n], "all") == 0)
+        program_rom = program_eeprom = program_config = true;
+      else if (::strcmp(argv[n], "rom") == 0)
+        program_rom = true;
+      else if (::strcmp(argv[n], "eeprom") == 0)
+        program_eeprom = true;
+      else if (::strcmp(argv[n], "config") == 0)
+        program_config = true;
+      else
+      {
+        fprintf(stderr, "Invalid argument (%s).\n", argv[n]);
+        return EXIT_FAILURE;
+      }
+      op = STATION;
+    }
     else if (op == NONE && ::strcmp(argv[n], "verify") == 0 && n < argc-1)
     {
       n += 1;
@@ -330,6 +465,14 @@ int main(int argc, char** argv)
       }
       op = ISBLANK;
     }
+    else if (op == NONE && ::strcmp(argv[n], "whichfw") == 0)
+    {
+      op = WHICHFW;
+    }
+    else if (op == WHICHFW && argv[n][0] != '-')
+    {
+      images.push_back(argv[n]);
+    }
     else if (op == NONE && ::strcmp(argv[n], "convert") == 0 && n < argc-1)
     {
       n += 1;
@@ -539,6 +682,108 @@ int main(int argc, char** argv)
     break;
   }
 
+  case STATION:
+  {
+    K150::HexData hex;
+    hex.setDebug(debug);
+    ok &= hex.loadHEX(newhex);
+    if (!ok)
+      break;
+
+    K150::CHIPDatabase db(datpath);
+    db.setDebug(debug);
+    ok &= db.load();
+    if (!ok)
+      break;
+    std::shared_ptr<const K150::CHIPInfo::INDEX> index = db.index();
+    ok &= load_chip_info(chip, *index, chipname);
+    if (!ok)
+      break;
+    ok &= programmer.configure(chip);
+    if (!ok)
+      break;
+    if (icsp || programmer.properties().socket_hint.empty())
+    {
+      fprintf(stderr, "Station requires a chip in the socket.\n");
+      ok = false;
+      break;
+    }
+
+    fprintf(stderr, "Initializing programmer on port '%s'.\n",
+            serialdev.c_str());
+    ok &= programmer.connect(&port);
+    if (!ok)
+      break;
+
+    // changes of the database are applied to the next chip
+    db.watch();
+
+    // follow the USB adapter, to resume when it comes back
+    Session session(port);
+    K150::USBMonitor monitor(&session);
+    monitor.setDebug(debug);
+    bool failover = monitor.watch(serialdev);
+
+    for (unsigned count = 1; ; ++count)
+    {
+      std::shared_ptr<const K150::CHIPInfo::INDEX> last = db.index();
+      if (last != index)
+      {
+        index = last;
+        K150::CHIPInfo update;
+        // the station runs in the socket only, keep a chip that can
+        if (load_chip_info(update, *index, chipname) && programmer.configure(update) &&
+                !programmer.properties().socket_hint.empty())
+          chip = update;
+        else
+        {
+          fprintf(stderr, "Keeping previous setup for chip %s.\n", chip.data().chip_name.c_str());
+          programmer.configure(chip);
+        }
+      }
+
+      if (program_pic(programmer, hex, ID, icsp,
+              true, program_rom, program_eeprom, program_config))
+        fprintf(stderr, "Chip #%u succeeded.\n", count);
+      else if (session.connected())
+        fprintf(stderr, "Chip #%u failed.\n", count);
+      else
+        --count; // the chip is not to blame, program it again
+
+      if (session.connected() && programmer.waitUntilChipOutOfSocket())
+        continue;
+      if (!failover)
+        break;
+
+      // the programmer is lost, wait for it then connect again
+      programmer.disconnect();
+      bool connected = false;
+      while (!connected)
+      {
+        // forget the last state, until the monitor tells it again
+        session.reset();
+        monitor.refresh();
+        session.waitConnected();
+        port.setDevice(monitor.device());
+        fprintf(stderr, "Initializing programmer on port '%s'.\n",
+                monitor.device().c_str());
+        // udev could still be setting up the device node
+        for (int attempt = 0; !connected && attempt < 10; ++attempt)
+        {
+          if (attempt > 0)
+            ::usleep(500000);
+          connected = programmer.connect(&port);
+        }
+      }
+    }
+
+    monitor.unwatch();
+    db.unwatch();
+    ok = false;
+    programmer.disconnect();
+    break;
+  }
+
   case VERIFY:
   {
     K150::HexData hex;
@@ -589,6 +834,34 @@ int main(int argc, char** argv)
     break;
   }
 
+  case WHICHFW:
+  {
+    if (images.empty())
+    {
+      fprintf(stderr, "Missing arguments.\n");
+      ok = false;
+      break;
+    }
+
+    ok &= load_chip_info(chip, datpath, chipname);
+    if (!ok)
+      break;
+    ok &= programmer.configure(chip);
+    if (!ok)
+      break;
+
+    fprintf(stderr, "Initializing programmer on port '%s'.\n",
+            serialdev.c_str());
+    ok &= programmer.connect(&port);
+    if (!ok)
+      break;
+
+    ok &= whichfw_pic(programmer, images, icsp);
+
+    programmer.disconnect();
+    break;
+  }
+
   case CONVERT:
   {
     if (newhex.empty() || outhex.empty() || range_end == 0)
@@ -734,6 +1007,19 @@ bool load_chip_info(K150::CHIPInfo& info, const std::string& datpath,
   return true;
 }
 
+bool load_chip_info(K150::CHIPInfo& info, const K150::CHIPInfo::INDEX& index,
+        const std::string& chipname)
+{
+  if (!info.loaddata(index, chipname))
+  {
+    fprintf(stderr, "Chip type '%s' is unknown.\n", chipname.c_str());
+    return false;
+  }
+  fprintf(stderr, "Chip type %s found in database with ID %s.\n",
+          info.data().chip_name.c_str(), info.data().chip_id.c_str());
+  return true;
+}
+
 bool read_pic(
         K150::Programmer& programmer,
         bool icsp_mode,
@@ -879,6 +1165,18 @@ bool erase_pic(
   if (!ok)
     return false;
 
+  // check the chip is the expected one before erasing
+  if (!programmer.checkChipID())
+  {
+    fprintf(stderr, "Operation aborted.\n");
+    programmer.setProgrammingVoltages(false);
+    programmer.commandEnd();
+    return false;
+  }
+  // reading the config leaves the address in config space, so reset it
+  if (!programmer.cycleProgrammingVoltages())
+    return false;
+
   fprintf(stderr, "Erasing Chip\n");
   ok &= programmer.eraseChip();
   if (!ok)
@@ -968,6 +1266,18 @@ bool program_pic(
     if (!ok)
       return false;
 
+    // Check the chip is the expected one before erasing or programming
+    if (!programmer.checkChipID())
+    {
+      fprintf(stderr, "Operation aborted.\n");
+      programmer.setProgrammingVoltages(false);
+      programmer.commandEnd();
+      return false;
+    }
+    // reading the config leaves the address in config space, so reset it
+    if (!programmer.cycleProgrammingVoltages())
+      return false;
+
     // Write ROM, EEPROM, ID and fuses
     if (props.flag_flash_chip &&
             program_rom && program_eeprom && program_config)
@@ -1263,3 +1573,155 @@ bool isblank_pic(
 
   return ok;
 }
+
+//
+// match the ROM read back against candidate images, block after block
+//
+
+#define WHICHFW_BLOCK_SIZE  64
+
+static uint64_t hash_block(const uint8_t * data, size_t len)
+{
+  // FNV-1a
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < len; ++i)
+  {
+    h ^= data[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+struct FIRMWARE
+{
+  std::string path;
+  std::vector<uint64_t> hashes; // hash of each block of the ROM image
+  bool candidate = true;
+};
+
+class FirmwareMatcher : public K150::ReadHandler
+{
+  std::vector<FIRMWARE>& m_list;
+  size_t m_size;
+  size_t m_offset = 0;
+  unsigned m_remaining;
+public:
+  FirmwareMatcher(std::vector<FIRMWARE>& list, size_t size)
+  : m_list(list), m_size(size), m_remaining(list.size()) { }
+
+  bool received(const std::vector<uint8_t>& data) override
+  {
+    // hash each complete block, and drop candidates on mismatch
+    while (m_offset < m_size)
+    {
+      size_t len = m_size - m_offset;
+      if (len > WHICHFW_BLOCK_SIZE)
+        len = WHICHFW_BLOCK_SIZE;
+      if (data.size() < m_offset + len)
+        break;
+      uint64_t h = hash_block(&data[m_offset], len);
+      size_t b = m_offset / WHICHFW_BLOCK_SIZE;
+      for (FIRMWARE& fw : m_list)
+      {
+        if (fw.candidate && fw.hashes[b] != h)
+        {
+          fw.candidate = false;
+          m_remaining -= 1;
+        }
+      }
+      m_offset += len;
+      // the last candidate is still compared to the end, else a chip
+      // carrying an unknown firmware would be identified
+      if (m_remaining == 0)
+        return false;
+    }
+    return true;
+  }
+};
+
+bool whichfw_pic(
+        K150::Programmer& programmer,
+        const std::vector<std::string>& images,
+        bool icsp_mode)
+{
+  const K150::Programmer::Properties& props = programmer.properties();
+  size_t rom_size = 2 * props.rom_size; // words to bytes
+
+  // hash the ROM blocks of each image
+  std::vector<FIRMWARE> list;
+  for (const std::string& path : images)
+  {
+    K150::HexData hex;
+    if (!hex.loadHEX(path))
+    {
+      fprintf(stderr, "Loading HEX file '%s' failed.\n", path.c_str());
+      return false;
+    }
+    // ROM word is LE for all cores, so swap bytes
+    std::vector<uint8_t> rom_data = hex.rangeOfData(props.rom_base, props.rom_size, props.rom_blank, true);
+    FIRMWARE fw;
+    fw.path = path;
+    for (size_t i = 0; i < rom_size; i += WHICHFW_BLOCK_SIZE)
+      fw.hashes.push_back(hash_block(&rom_data[i], std::min<size_t>(WHICHFW_BLOCK_SIZE, rom_size - i)));
+    list.push_back(std::move(fw));
+  }
+
+  bool ok = true;
+
+  // Instruct user to insert chip
+  if (icsp_mode || props.socket_hint.empty())
+    fprintf(stderr, "Accessing chip connected to ICSP port.\n");
+  else
+  {
+    ok &= programmer.waitUntilChipInSocket();
+    if (!ok)
+      return false;
+    ::sleep(1);
+  }
+
+  // start command session
+  if (!programmer.commandStart())
+    return false;
+
+  // Initialize programming variables
+  ok &= programmer.initializeProgrammingVariables(icsp_mode);
+  if (!ok)
+    return false;
+
+  ok &= programmer.setProgrammingVoltages(true);
+  if (!ok)
+    return false;
+
+  fprintf(stderr, "Matching ROM against %u images\n", (unsigned) list.size());
+  FirmwareMatcher matcher(list, rom_size);
+  std::vector<uint8_t> buf;
+  ok &= programmer.readROM(buf, &matcher);
+  if (!ok)
+    fprintf(stderr, "Command failed.\n");
+  else
+  {
+    unsigned found = 0;
+    for (const FIRMWARE& fw : list)
+    {
+      if (fw.candidate)
+      {
+        fprintf(stdout, "%s\n", fw.path.c_str());
+        found += 1;
+      }
+    }
+    if (found == 0)
+    {
+      fprintf(stderr, "Firmware not identified.\n");
+      ok = false;
+    }
+    else
+      fprintf(stderr, "Firmware identified.\n");
+  }
+
+  ok &= programmer.setProgrammingVoltages(false);
+
+  // end command session
+  programmer.commandEnd();
+
+  return ok;
+}
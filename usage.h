@@ -170,60 +170,105 @@ unsigned char usage_txt[] = {
   0x6e, 0x66, 0x69, 0x67, 0x22, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x70,
   0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x49, 0x44, 0x20, 0x61, 0x6e,
   0x64, 0x20, 0x46, 0x55, 0x53, 0x45, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79,
-  0x2e, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x3c,
-  0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3e, 0x20, 0x2d, 0x74, 0x20, 0x3c,
-  0x43, 0x48, 0x49, 0x50, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x3e, 0x20, 0x2d,
-  0x69, 0x20, 0x3c, 0x48, 0x45, 0x58, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x3e,
-  0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52, 0x54, 0x3e, 0x20, 0x5b,
-  0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73, 0x70, 0x20, 0x5d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x43, 0x48, 0x49, 0x50, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x61,
-  0x63, 0x63, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 0x69,
-  0x6c, 0x74, 0x65, 0x72, 0x20, 0x72, 0x6f, 0x6d, 0x20, 0x7c, 0x20, 0x65,
-  0x65, 0x70, 0x72, 0x6f, 0x6d, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72,
-  0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x48, 0x45, 0x58, 0x20, 0x73, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x65, 0x72, 0x61, 0x73, 0x65, 0x20,
+  0x2e, 0x0a, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x3c, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3e, 0x20, 0x2d, 0x74, 0x20,
+  0x3c, 0x43, 0x48, 0x49, 0x50, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x3e, 0x20,
+  0x2d, 0x69, 0x20, 0x3c, 0x48, 0x45, 0x58, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52, 0x54, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x75, 0x6e, 0x20, 0x22, 0x70,
+  0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x43, 0x48, 0x49, 0x50, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x65,
+  0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+  0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c,
+  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x65, 0x72, 0x20, 0x73, 0x74,
+  0x6f, 0x70, 0x73, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69,
+  0x6e, 0x67, 0x2e, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62,
+  0x61, 0x73, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65,
+  0x78, 0x74, 0x20, 0x43, 0x48, 0x49, 0x50, 0x2e, 0x20, 0x57, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x53, 0x42, 0x20, 0x61, 0x64,
+  0x61, 0x70, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x65, 0x72, 0x20,
+  0x69, 0x73, 0x20, 0x70, 0x6c, 0x75, 0x67, 0x67, 0x65, 0x64, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x74,
+  0x20, 0x77, 0x61, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69,
+  0x74, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x62, 0x61,
+  0x63, 0x6b, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x73,
+  0x75, 0x6d, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x72, 0x69,
+  0x66, 0x79, 0x20, 0x3c, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3e, 0x20,
   0x2d, 0x74, 0x20, 0x3c, 0x43, 0x48, 0x49, 0x50, 0x5f, 0x4e, 0x41, 0x4d,
-  0x45, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52, 0x54, 0x3e,
-  0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73, 0x70, 0x20, 0x5d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x72, 0x61, 0x73, 0x65, 0x20,
-  0x61, 0x6c, 0x6c, 0x20, 0x61, 0x72, 0x65, 0x61, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x43, 0x48, 0x49, 0x50, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-  0x64, 0x69, 0x6e, 0x67, 0x20, 0x52, 0x4f, 0x4d, 0x20, 0x45, 0x45, 0x50,
-  0x52, 0x4f, 0x4d, 0x20, 0x49, 0x44, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x46,
-  0x55, 0x53, 0x45, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x64, 0x75, 0x6d, 0x70,
-  0x20, 0x3c, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3e, 0x20, 0x2d, 0x74,
-  0x20, 0x3c, 0x43, 0x48, 0x49, 0x50, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x3e,
-  0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52, 0x54, 0x3e, 0x20, 0x5b,
-  0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73, 0x70, 0x20, 0x2d, 0x6f, 0x20, 0x3c,
-  0x48, 0x45, 0x58, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x3e, 0x20, 0x5d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x61, 0x64, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x68, 0x69, 0x70, 0x20, 0x61, 0x63, 0x63, 0x6f,
-  0x72, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65,
-  0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x7c, 0x20, 0x72, 0x6f, 0x6d, 0x20,
-  0x7c, 0x20, 0x65, 0x65, 0x70, 0x72, 0x6f, 0x6d, 0x20, 0x7c, 0x20, 0x63,
-  0x6f, 0x6e, 0x66, 0x69, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20,
-  0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x73, 0x61, 0x76, 0x65,
-  0x20, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x48, 0x45, 0x58, 0x20, 0x66,
-  0x69, 0x6c, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x69, 0x73, 0x62, 0x6c, 0x61,
-  0x6e, 0x6b, 0x20, 0x3c, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3e, 0x20,
-  0x2d, 0x74, 0x20, 0x3c, 0x43, 0x48, 0x49, 0x50, 0x5f, 0x4e, 0x41, 0x4d,
-  0x45, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52, 0x54, 0x3e,
-  0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73, 0x70, 0x20, 0x5d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x62,
-  0x6c, 0x61, 0x6e, 0x6b, 0x2c, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x72, 0x64,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
-  0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x20,
+  0x45, 0x3e, 0x20, 0x2d, 0x69, 0x20, 0x3c, 0x48, 0x45, 0x58, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52,
+  0x54, 0x3e, 0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73, 0x70, 0x20,
+  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x61, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x48, 0x49, 0x50, 0x20, 0x61, 0x72,
+  0x65, 0x61, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65,
+  0x6e, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x72, 0x6f, 0x6d,
+  0x20, 0x7c, 0x20, 0x65, 0x65, 0x70, 0x72, 0x6f, 0x6d, 0x2c, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+  0x6d, 0x70, 0x61, 0x72, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x45, 0x58, 0x20,
+  0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x65, 0x72,
+  0x61, 0x73, 0x65, 0x20, 0x2d, 0x74, 0x20, 0x3c, 0x43, 0x48, 0x49, 0x50,
+  0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50,
+  0x4f, 0x52, 0x54, 0x3e, 0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73,
+  0x70, 0x20, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x72,
+  0x61, 0x73, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x72, 0x65, 0x61,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x48, 0x49, 0x50, 0x2c, 0x20, 0x69,
+  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x52, 0x4f, 0x4d,
+  0x20, 0x45, 0x45, 0x50, 0x52, 0x4f, 0x4d, 0x20, 0x49, 0x44, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x46, 0x55, 0x53, 0x45, 0x73, 0x2e, 0x0a, 0x20, 0x20,
+  0x64, 0x75, 0x6d, 0x70, 0x20, 0x3c, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72,
+  0x3e, 0x20, 0x2d, 0x74, 0x20, 0x3c, 0x43, 0x48, 0x49, 0x50, 0x5f, 0x4e,
+  0x41, 0x4d, 0x45, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50, 0x4f, 0x52,
+  0x54, 0x3e, 0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73, 0x70, 0x20,
+  0x2d, 0x6f, 0x20, 0x3c, 0x48, 0x45, 0x58, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x3e, 0x20, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65,
+  0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x69, 0x70, 0x20,
+  0x61, 0x63, 0x63, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x66,
+  0x69, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x7c, 0x20,
   0x72, 0x6f, 0x6d, 0x20, 0x7c, 0x20, 0x65, 0x65, 0x70, 0x72, 0x6f, 0x6d,
-  0x2e, 0x0a
+  0x20, 0x7c, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x72, 0x20,
+  0x73, 0x61, 0x76, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x48,
+  0x45, 0x58, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x69,
+  0x73, 0x62, 0x6c, 0x61, 0x6e, 0x6b, 0x20, 0x3c, 0x66, 0x69, 0x6c, 0x74,
+  0x65, 0x72, 0x3e, 0x20, 0x2d, 0x74, 0x20, 0x3c, 0x43, 0x48, 0x49, 0x50,
+  0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50,
+  0x4f, 0x52, 0x54, 0x3e, 0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73,
+  0x70, 0x20, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+  0x72, 0x79, 0x20, 0x62, 0x6c, 0x61, 0x6e, 0x6b, 0x2c, 0x20, 0x61, 0x63,
+  0x63, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 0x69, 0x6c,
+  0x74, 0x65, 0x72, 0x20, 0x72, 0x6f, 0x6d, 0x20, 0x7c, 0x20, 0x65, 0x65,
+  0x70, 0x72, 0x6f, 0x6d, 0x2e, 0x0a, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x66, 0x77, 0x20, 0x2d, 0x74, 0x20, 0x3c, 0x43, 0x48, 0x49, 0x50,
+  0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x3e, 0x20, 0x2d, 0x70, 0x20, 0x3c, 0x50,
+  0x4f, 0x52, 0x54, 0x3e, 0x20, 0x5b, 0x20, 0x2d, 0x2d, 0x69, 0x63, 0x73,
+  0x70, 0x20, 0x5d, 0x20, 0x3c, 0x48, 0x45, 0x58, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x3e, 0x20, 0x2e, 0x2e, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x52, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x4f,
+  0x4d, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x48, 0x49, 0x50, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20,
+  0x48, 0x45, 0x58, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67,
+  0x20, 0x69, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x65, 0x72, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x73, 0x20,
+  0x61, 0x73, 0x20, 0x73, 0x6f, 0x6f, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x6e,
+  0x6f, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69, 0x64, 0x61, 0x74, 0x65, 0x20,
+  0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x73, 0x2e, 0x0a
 };
-unsigned int usage_txt_len = 2702;
+unsigned int usage_txt_len = 3249;
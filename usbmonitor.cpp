@@ -0,0 +1,253 @@
+/*
+ *      Copyright (C) 2025 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "usbmonitor.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <climits>
+
+#include <unistd.h>
+#include <poll.h>
+#include <dirent.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#define SYSFS_TTY       "/sys/class/tty/"
+#define POLL_PERIOD     500
+
+namespace K150
+{
+
+static std::string read_attribute(const std::string& path)
+{
+  std::string value;
+  FILE * file = fopen(path.c_str(), "r");
+  if (file == nullptr)
+    return value;
+  char buf[256];
+  if (fgets(buf, sizeof(buf), file) != nullptr)
+  {
+    value.assign(buf);
+    while (!value.empty() && (value.back() == '\n' || value.back() == ' '))
+      value.pop_back();
+  }
+  fclose(file);
+  return value;
+}
+
+USBMonitor::~USBMonitor()
+{
+  unwatch();
+}
+
+bool USBMonitor::identify(const std::string& tty, std::string& serial, std::string& port)
+{
+  char buf[PATH_MAX];
+  std::string path = SYSFS_TTY + tty + "/device";
+  if (realpath(path.c_str(), buf) == nullptr)
+    return false;
+  path.assign(buf);
+  // walk up to the USB device
+  for (;;)
+  {
+    size_t p = path.find_last_of('/');
+    if (p == std::string::npos || p == 0)
+      return false;
+    if (access((path + "/idVendor").c_str(), F_OK) == 0)
+      break;
+    path.resize(p);
+  }
+  serial = read_attribute(path + "/serial");
+  port = path.substr(path.find_last_of('/') + 1);
+  return true;
+}
+
+bool USBMonitor::watch(const std::string& device)
+{
+  if (m_thread.joinable())
+    return true;
+
+  std::string node = device;
+  char buf[PATH_MAX];
+  if (realpath(device.c_str(), buf) != nullptr)
+    node.assign(buf);
+  m_tty = node.substr(node.find_last_of('/') + 1);
+  if (!identify(m_tty, m_serial, m_port))
+  {
+    fprintf(stderr, "Device '%s' is not an USB adapter.\n", device.c_str());
+    return false;
+  }
+  if (m_debug)
+    fprintf(stderr, ">>> USB adapter on port %s with serial '%s'\n",
+            m_port.c_str(), m_serial.c_str());
+  {
+    std::lock_guard<std::mutex> g(m_lock);
+    m_device = device;
+  }
+
+  // kernel uevents, else poll sysfs
+  int fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+  if (fd >= 0)
+  {
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = 1;
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+    {
+      close(fd);
+      fd = -1;
+    }
+  }
+  if (fd < 0 && m_debug)
+    fprintf(stderr, ">>> Netlink is not available, polling sysfs\n");
+
+  m_stop = false;
+  m_thread = std::thread(&USBMonitor::run, this, fd);
+  return true;
+}
+
+void USBMonitor::unwatch()
+{
+  if (!m_thread.joinable())
+    return;
+  m_stop = true;
+  m_thread.join();
+}
+
+void USBMonitor::refresh()
+{
+  // the state of the adapter will be notified again
+  m_refresh = true;
+}
+
+std::string USBMonitor::device()
+{
+  std::lock_guard<std::mutex> g(m_lock);
+  return m_device;
+}
+
+bool USBMonitor::scan(std::string& device)
+{
+  DIR * dir = opendir(SYSFS_TTY);
+  if (dir == nullptr)
+    return false;
+  bool found = false;
+  struct dirent * entry;
+  while (!found && (entry = readdir(dir)) != nullptr)
+  {
+    if (entry->d_name[0] == '.')
+      continue;
+    std::string serial, port;
+    if (!identify(entry->d_name, serial, port))
+      continue;
+    // without serial number, the adapter must come back on the same port
+    if (m_serial.empty() ? port == m_port : serial == m_serial)
+    {
+      device.assign("/dev/").append(entry->d_name);
+      found = true;
+    }
+  }
+  closedir(dir);
+  return found;
+}
+
+void USBMonitor::run(int fd)
+{
+  bool connected = true;
+
+  while (!m_stop)
+  {
+    std::string device;
+    bool present = connected;
+
+    if (m_refresh.exchange(false))
+    {
+      connected = false;
+      present = scan(device);
+    }
+    else if (fd >= 0)
+    {
+      struct pollfd pfd;
+      pfd.fd = fd;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+      // wake up periodically to check for stop
+      if (poll(&pfd, 1, POLL_PERIOD) <= 0)
+        continue;
+      char buf[4096];
+      ssize_t len = recv(fd, buf, sizeof(buf) - 1, MSG_DONTWAIT);
+      if (len <= 0)
+        continue;
+      buf[len] = '\0';
+      // the message is a list of strings: ACTION@DEVPATH, KEY=VALUE, ...
+      std::string action, subsystem, devname;
+      for (char * ptr = buf; ptr < buf + len; ptr += strlen(ptr) + 1)
+      {
+        if (strncmp(ptr, "ACTION=", 7) == 0)
+          action.assign(ptr + 7);
+        else if (strncmp(ptr, "SUBSYSTEM=", 10) == 0)
+          subsystem.assign(ptr + 10);
+        else if (strncmp(ptr, "DEVNAME=", 8) == 0)
+          devname.assign(ptr + 8);
+      }
+      if (subsystem != "tty")
+        continue;
+      // the sysfs entry could remain until the event is processed, so the
+      // removal is checked against the tty name
+      if (connected && action == "remove")
+        present = (devname != m_tty);
+      else if (!connected && action == "add")
+        present = scan(device);
+    }
+    else
+    {
+      usleep(POLL_PERIOD * 1000);
+      present = scan(device);
+      // re-enumerated between two polls
+      if (present && connected && device.compare(device.find_last_of('/') + 1, std::string::npos, m_tty) != 0)
+      {
+        connected = false;
+        if (m_callback != nullptr)
+          m_callback->status(false);
+      }
+    }
+
+    if (present == connected)
+      continue;
+    connected = present;
+    if (present)
+    {
+      std::lock_guard<std::mutex> g(m_lock);
+      m_device = device;
+      m_tty = device.substr(device.find_last_of('/') + 1);
+    }
+    if (m_debug)
+      fprintf(stderr, ">>> USB adapter %s %s\n", (present ? "added as" : "removed from"),
+              (present ? device.c_str() : m_port.c_str()));
+    if (m_callback != nullptr)
+      m_callback->status(present);
+  }
+
+  if (fd >= 0)
+    close(fd);
+}
+
+}
@@ -0,0 +1,69 @@
+/*
+ *      Copyright (C) 2025 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef USBMONITOR_H
+#define USBMONITOR_H
+
+#include "k150.h"
+
+#include <string>
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+namespace K150
+{
+
+// Tracks the USB adapter of the programmer by its serial number, or by its
+// port path when the adapter has none. Kernel uevents are monitored, else
+// sysfs is polled. The callback is notified from the monitoring thread when
+// the adapter disappears or comes back, possibly with a new tty node.
+class USBMonitor
+{
+public:
+  USBMonitor(Callback * callback) : m_callback(callback) { }
+  ~USBMonitor();
+
+  void setDebug(bool debug) { m_debug = debug; }
+
+  bool watch(const std::string& device);
+  void unwatch();
+  void refresh();
+
+  std::string device();
+
+private:
+  void run(int fd);
+  bool scan(std::string& device);
+  static bool identify(const std::string& tty, std::string& serial, std::string& port);
+
+  Callback * m_callback;
+  bool m_debug = false;
+  std::string m_serial;   // USB serial number
+  std::string m_port;     // USB port path, i.e 1-1.2
+  std::mutex m_lock;
+  std::string m_device;   // current device path
+  std::string m_tty;      // current tty name, i.e ttyUSB0
+  std::thread m_thread;
+  std::atomic<bool> m_stop { false };
+  std::atomic<bool> m_refresh { false };
+};
+
+}
+
+#endif /* USBMONITOR_H */